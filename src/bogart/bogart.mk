@@ -11,6 +11,7 @@ TARGET   := bogart
 SOURCES  := bogart.C \
             AS_BAT_AssemblyGraph.C \
             AS_BAT_BestOverlapGraph.C \
+            AS_BAT_Checkpoint.C \
             AS_BAT_ChunkGraph.C \
             AS_BAT_CreateUnitigs.C \
             AS_BAT_DetectSpurs.C \
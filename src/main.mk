@@ -56,6 +56,7 @@ SOURCES      := AS_global.C \
                 utility/md5.C \
                 utility/mt19937ar.C \
                 utility/objectStore.C \
+                utility/performanceReport.C \
                 utility/speedCounter.C \
                 utility/sweatShop.C \
                 \
@@ -75,9 +76,11 @@ SOURCES      := AS_global.C \
                 stores/ovOverlap.C \
                 stores/ovStore.C \
                 stores/ovStoreWriter.C \
+                stores/ovStoreReader.C \
                 stores/ovStoreFilter.C \
                 stores/ovStoreFile.C \
                 stores/ovStoreHistogram.C \
+                stores/ovTextConvert.C \
                 \
                 stores/tgStore.C \
                 stores/tgTig.C \
@@ -96,6 +99,7 @@ SOURCES      := AS_global.C \
                 overlapInCore/liboverlap/prefixEditDistance-allocateMoreSpace.C \
                 overlapInCore/liboverlap/prefixEditDistance-extend.C \
                 overlapInCore/liboverlap/prefixEditDistance-forward.C \
+                overlapInCore/liboverlap/prefixEditDistance-matchRun.C \
                 overlapInCore/liboverlap/prefixEditDistance-reverse.C \
                 \
                 utgcns/libNDalign/NDalign.C \
@@ -216,6 +220,12 @@ ifeq ($(BUILDTESTS), 1)
 SUBMAKEFILES += utility/bitsTest.mk \
                 utility/filesTest.mk \
                 utility/intervalListTest.mk \
+                utility/kernelBench.mk \
                 utility/loggingTest.mk \
-                utility/stddevTest.mk
+                utility/performanceReportTest.mk \
+                utility/sequenceCodecTest.mk \
+                utility/sequenceTest.mk \
+                utility/stddevTest.mk \
+                stores/ovFileTest.mk \
+                overlapInCore/liboverlap/prefixEditDistanceBench.mk
 endif
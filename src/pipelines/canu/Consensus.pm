@@ -111,15 +111,18 @@ sub utgcns ($$$) {
     print F "  -O ./\${tag}cns/\$jobid.cns.WORKING \\\n";
     print F "  -maxcoverage " . getGlobal('cnsMaxCoverage') . " \\\n";
     print F "  -e " . getGlobal("cnsErrorRate") . " \\\n";
+    print F "  -window " . getGlobal("cnsWindowLength") . " \\\n"   if (defined(getGlobal("cnsWindowLength")));
     print F "  -quick \\\n"      if (getGlobal("cnsConsensus") eq "quick");
     print F "  -pbdagcon \\\n"   if (getGlobal("cnsConsensus") eq "pbdagcon");
     print F "  -edlib    \\\n"   if (getGlobal("canuIteration") >= 0);
     print F "  -utgcns \\\n"     if (getGlobal("cnsConsensus") eq "utgcns");
     print F "  -threads " . getGlobal("cnsThreads") . " \\\n";
+    print F "  -costs ./\${tag}cns/\$jobid.costs \\\n";
     print F "&& \\\n";
     print F "mv ./\${tag}cns/\$jobid.cns.WORKING ./\${tag}cns/\$jobid.cns \\\n";
     print F "\n";
     print F stashFileShellCode("unitigging/5-consensus", "\${tag}cns/\$jobid.cns", "");
+    print F stashFileShellCode("unitigging/5-consensus", "\${tag}cns/\$jobid.costs", "");
     print F "\n";
     print F "exit 0\n";
 
@@ -150,11 +153,31 @@ sub partitionTigs ($$) {
     # adjust for the fact that compressed contigs will likely expand and thus take more memory/more space
     my $partitionScaling = (defined(getGlobal("homoPolyCompress"))) ? 1.5 : 1.0;
 
+    # balance partitions by the time consensus took in earlier runs: any
+    # costs left by consensus jobs here (if the partitioning was removed to
+    # recompute consensus) and any supplied with cnsCostModel.  Without
+    # enough of them, utgcns partitions on consensus area.
+
+    my @costFiles;
+
+    foreach my $f (glob("unitigging/5-consensus/${tag}cns/*.costs")) {
+        $f =~ s!^unitigging/!./!;
+        push @costFiles, $f;
+    }
+
+    if (defined(getGlobal("cnsCostModel"))) {
+        caExit("cnsCostModel '" . getGlobal("cnsCostModel") . "' doesn't exist", undef)   if (! -e getGlobal("cnsCostModel"));
+        push @costFiles, getGlobal("cnsCostModel");
+    }
+
     $cmd  = "$bin/utgcns \\\n";
     $cmd .= "  -S ../$asm.seqStore \\\n";
     $cmd .= "  -T  ./$asm.${tag}Store 1 \\\n";
     #$cmd .= "  -partition " . getGlobal("cnsPartitionSize") . " \\\n"   if (defined(getGlobal("cnsPartitionSize")));
     $cmd .= "  -partition 0.8 $partitionScaling 0.1 \\\n";
+    $cmd .= "  -quick \\\n"      if (getGlobal("cnsConsensus") eq "quick");
+    $cmd .= "  -pbdagcon \\\n"   if (getGlobal("cnsConsensus") eq "pbdagcon");
+    $cmd .= "  -costmodel $_ \\\n"   foreach (@costFiles);
     $cmd .= "> ./$asm.${tag}Store/partitioning.log 2>&1";
 
     if (runCommand("unitigging", $cmd)) {
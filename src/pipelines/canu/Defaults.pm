@@ -1059,6 +1059,8 @@ sub setDefaults () {
 
     setDefault("cnsMaxCoverage",  40,          "Limit unitig consensus to at most this coverage; default '40' = unlimited");
     setDefault("cnsConsensus",    "pbdagcon",  "Which consensus algorithm to use; 'pbdagcon' (fast, reliable); 'utgcns' (multialignment output); 'quick' (single read mosaic); default 'pbdagcon'");
+    setDefault("cnsWindowLength", undef,       "Compute consensus for tigs at least this long in parallel windows; default: never");
+    setDefault("cnsCostModel",    undef,       "Balance consensus jobs using the per-tig times in this file, from the *.costs of an earlier assembly; default: consensus area");
 
     #####  Correction Options
 
@@ -1360,6 +1362,7 @@ sub checkParameters () {
     makeAbsolute("corOvlFrequentMers");
     makeAbsolute("obtOvlFrequentMers");
     makeAbsolute("utgOvlFrequentMers");
+    makeAbsolute("cnsCostModel");
 
     #
     #  Adjust case on some of them
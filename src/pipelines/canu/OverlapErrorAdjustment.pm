@@ -190,6 +190,12 @@ sub readErrorDetectionConfigure ($) {
     my $maxReads     = getGlobal("redBatchSize");
     my $maxBases     = getGlobal("redBatchLength");
 
+    #  Bytes per base for sequence and votes; see the memory usage comment below.
+
+    my $bytesPerBase = 7 + 1100 * getGlobal("utgOvlErrorRate");
+
+    $bytesPerBase = 128   if ($bytesPerBase > 128);
+
     print STDERR "--\n";
     print STDERR "-- Configure RED for ", getGlobal("redMemory"), "gb memory.\n";
     print STDERR "--                   Batches of at most ", ($maxReads > 0) ? $maxReads : "(unlimited)", " reads.\n";
@@ -221,10 +227,17 @@ sub readErrorDetectionConfigure ($) {
         #
         #  Per base/vote:
         #    1 byte  for sequence
-        #   32 bytes for Vote_Tally_t // why 32 made up number, why random 4 gb padding?
+        #    6 bytes for Vote_Count_t
+        #   ~30 bytes for Vote_Diff_t and ~80 bytes for Vote_Ins_t, but only for bases with a
+        #       deletion, substitution or insertion vote.  The number of those grows with the
+        #       error rate.  Measured totals at 30x coverage were 10 bytes per base for reads
+        #       with 0.3% error and 20 bytes per base for reads with 1.2% error (overlaps with
+        #       about 2.4% differences).  Allow 7 + 1100 * utgOvlErrorRate bytes per base, about
+        #       twice what was measured, but never more than 128, which covers a vote of every
+        #       kind at every base.
         #
         #  Per read:
-        #   32 bytes for Frag_Info_t
+        #  104 bytes for Frag_Info_t
         #
         #  Per olap:
         #   12 bytes for Olap_Info_t
@@ -237,7 +250,7 @@ sub readErrorDetectionConfigure ($) {
         #
         #  Throw in another 2 GB for unknown overheads (seqStore, ovlStore) and alignment generation.
 
-        my $memory = (128 * $bases) + (33 * $reads) + (12 * $olaps) + (2 * $maxBlockSize) + 2 * 1024 * 1024 * 1024;
+        my $memory = ($bytesPerBase * $bases) + (104 * $reads) + (12 * $olaps) + (2 * $maxBlockSize) + 2 * 1024 * 1024 * 1024;
 
         if ((($maxMem   > 0) && ($memory >= $maxMem))    ||
             (($maxReads > 0) && ($reads  >= $maxReads))  ||
@@ -250,7 +263,7 @@ sub readErrorDetectionConfigure ($) {
                    $memory / 1024 / 1024,
                    $bgn[$nj], $end[$nj],
                    $reads,
-                   $bases,               (128 * $bases + 33 * $reads)  / 1024 / 1024,
+                   $bases,               ($bytesPerBase * $bases + 104 * $reads)  / 1024 / 1024,
                    $olaps,               (12 * $olaps)                / 1024 / 1024,
                    2 * $maxBlockSize / 1024 / 1024);
 
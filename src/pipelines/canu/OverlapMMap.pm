@@ -350,7 +350,8 @@ sub mmapConfigure ($$$) {
     print F "  exit 1\n";
     print F "fi\n";
     print F "\n";
-    print F "if [ -e ./results/\$qry.ovb ]; then\n";
+    print F "if [ -e ./results/\$qry.ovb ]; then\n"    if (getGlobal("${tag}ReAlign") eq "1");
+    print F "if [ -e ./results/\$qry.mmap ]; then\n"   if (getGlobal("${tag}ReAlign") ne "1");
     print F "  echo Job previously completed successfully.\n";
     print F "  exit\n";
     print F "fi\n";
@@ -402,30 +403,39 @@ sub mmapConfigure ($$$) {
     print F "mv  ./results/\$qry.mmap.WORKING  ./results/\$qry.mmap\n";
     print F "\n";
 
-    print F "if [   -e ./results/\$qry.mmap -a \\\n";
-    print F "     ! -e ./results/\$qry.ovb ] ; then\n";
-    print F "  \$bin/mmapConvert \\\n";
-    print F "    -S ../../$asm.seqStore \\\n";
-    print F "    -o ./results/\$qry.mmap.ovb.WORKING \\\n";
-    print F "    -e " . getGlobal("${tag}OvlErrorRate");
-    print F "    -partial \\\n"  if ($typ eq "partial");
-    print F "    -len "  , getGlobal("minOverlapLength"),  " \\\n";
-    print F "    ./results/\$qry.mmap \\\n";
-    print F "  && \\\n";
-    print F "  mv ./results/\$qry.mmap.ovb.WORKING ./results/\$qry.mmap.ovb\n";
-    print F "fi\n";
-    print F "\n";
+    #  Unless realigning, the minimap output is the result; the overlap store
+    #  bucketizer reads it directly, without converting to ovb first.
+
+    if (getGlobal("${tag}ReAlign") ne "1") {
+        print F stashFileShellCode("$path", "results/\$qry.mmap", "");
+        print F "\n";
+    }
 
-    if (getGlobal('purgeOverlaps') ne "never") {
+    else {
         print F "if [   -e ./results/\$qry.mmap -a \\\n";
-        print F "       -e ./results/\$qry.mmap.ovb ] ; then\n";
-        print F "  rm -f ./results/\$qry.mmap\n";
+        print F "     ! -e ./results/\$qry.ovb ] ; then\n";
+        print F "  \$bin/mmapConvert \\\n";
+        print F "    -S ../../$asm.seqStore \\\n";
+        print F "    -o ./results/\$qry.mmap.ovb.WORKING \\\n";
+        print F "    -e " . getGlobal("${tag}OvlErrorRate");
+        print F "    -partial \\\n"  if ($typ eq "partial");
+        print F "    -len "  , getGlobal("minOverlapLength"),  " \\\n";
+        print F "    -t "    , getGlobal("${tag}mmapThreads"),   " \\\n";
+        print F "    ./results/\$qry.mmap \\\n";
+        print F "  && \\\n";
+        print F "  mv ./results/\$qry.mmap.ovb.WORKING ./results/\$qry.mmap.ovb\n";
         print F "fi\n";
         print F "\n";
-    }
 
-    print F "if [ -e ./results/\$qry.mmap.ovb ] ; then\n";
-    if (getGlobal("${tag}ReAlign") eq "1") {
+        if (getGlobal('purgeOverlaps') ne "never") {
+            print F "if [   -e ./results/\$qry.mmap -a \\\n";
+            print F "       -e ./results/\$qry.mmap.ovb ] ; then\n";
+            print F "  rm -f ./results/\$qry.mmap\n";
+            print F "fi\n";
+            print F "\n";
+        }
+
+        print F "if [ -e ./results/\$qry.mmap.ovb ] ; then\n";
         print F "  \$bin/overlapPair \\\n";
         print F "    -S ../../$asm.seqStore \\\n";
         print F "    -O ./results/\$qry.mmap.ovb \\\n";
@@ -436,15 +446,12 @@ sub mmapConfigure ($$$) {
         print F "    -erate ", getGlobal("utgOvlErrorRate"), " \\\n"  if ($tag eq "utg");
         print F "    -memory " . getGlobal("${tag}mmapMemory") . " \\\n";
         print F "    -t " . getGlobal("${tag}mmapThreads") . " \n";
-    } else {
-        print F "  mv -f ./results/\$qry.mmap.ovb ./results/\$qry.ovb\n";
-        print F "  mv -f ./results/\$qry.mmap.oc  ./results/\$qry.oc\n";
-    }
-    print F "fi\n";
+        print F "fi\n";
 
-    print F stashFileShellCode("$path", "results/\$qry.ovb", "");
-    print F stashFileShellCode("$path", "results/\$qry.oc",  "");
-    print F "\n";
+        print F stashFileShellCode("$path", "results/\$qry.ovb", "");
+        print F stashFileShellCode("$path", "results/\$qry.oc",  "");
+        print F "\n";
+    }
 
     print F "\n";
     print F "exit 0\n";
@@ -640,6 +647,10 @@ sub mmapCheck ($$$) {
                 push @miscJobs,    "1-overlapper/results/$1.stats\n";
                 push @miscJobs,    "1-overlapper/results/$1.oc\n";
 
+            } elsif ((getGlobal("${tag}ReAlign") ne "1") &&          #  Not converted to ovb; the
+                     (fileExists("$path/results/$1.mmap"))) {        #  store loads it directly.
+                push @successJobs, "1-overlapper/results/$1.mmap\n";
+
             } else {
                 $failureMessage .= "--   job $path/results/$1.ovb FAILED.\n";
                 push @failedJobs, $currentJobID;
@@ -427,7 +427,8 @@ sub mhapConfigure ($$$) {
     print F "  exit 1\n";
     print F "fi\n";
     print F "\n";
-    print F "if [ -e ./results/\$qry.ovb ]; then\n";
+    print F "if [ -e ./results/\$qry.ovb ]; then\n"    if (getGlobal("${tag}ReAlign") eq "1");
+    print F "if [ -e ./results/\$qry.mhap ]; then\n"   if (getGlobal("${tag}ReAlign") ne "1");
     print F "  echo Job previously completed successfully.\n";
     print F "  exit\n";
     print F "fi\n";
@@ -495,26 +496,41 @@ sub mhapConfigure ($$$) {
     print F "fi\n";
     print F "\n";
 
-    print F "if [   -e \$outPath/\$qry.mhap -a \\\n";
-    print F "     ! -e ./results/\$qry.ovb ] ; then\n";
-    print F "  \$bin/mhapConvert \\\n";
-    print F "    -S ../../$asm.seqStore \\\n";
-    print F "    -o ./results/\$qry.mhap.ovb.WORKING \\\n";
-    print F "    \$outPath/\$qry.mhap \\\n";
-    print F "  && \\\n";
-    print F "  mv ./results/\$qry.mhap.ovb.WORKING ./results/\$qry.mhap.ovb\n";
-    print F "fi\n";
-    print F "\n";
+    #  Unless realigning, the mhap output is the result; the overlap store
+    #  bucketizer reads it directly, without converting to ovb first.  It
+    #  needs to be moved out of the staging directory, if that's used.
 
-    if (getGlobal('purgeOverlaps') ne "never") {
+    if (getGlobal("${tag}ReAlign") ne "1") {
         print F "if [   -e \$outPath/\$qry.mhap -a \\\n";
-        print F "       -e ./results/\$qry.mhap.ovb ] ; then\n";
-        print F "  rm -f \$outPath/\$qry.mhap\n";
+        print F "     ! -e ./results/\$qry.mhap ] ; then\n";
+        print F "  mv -f \$outPath/\$qry.mhap ./results/\$qry.mhap\n";
         print F "fi\n";
         print F "\n";
+        print F stashFileShellCode($path, "results/\$qry.mhap", "");
+        print F "\n";
     }
 
-    if (getGlobal("${tag}ReAlign") eq "1") {
+    else {
+        print F "if [   -e \$outPath/\$qry.mhap -a \\\n";
+        print F "     ! -e ./results/\$qry.ovb ] ; then\n";
+        print F "  \$bin/mhapConvert \\\n";
+        print F "    -S ../../$asm.seqStore \\\n";
+        print F "    -o ./results/\$qry.mhap.ovb.WORKING \\\n";
+        print F "    -t ", getGlobal("${tag}mhapThreads"), " \\\n";
+        print F "    \$outPath/\$qry.mhap \\\n";
+        print F "  && \\\n";
+        print F "  mv ./results/\$qry.mhap.ovb.WORKING ./results/\$qry.mhap.ovb\n";
+        print F "fi\n";
+        print F "\n";
+
+        if (getGlobal('purgeOverlaps') ne "never") {
+            print F "if [   -e \$outPath/\$qry.mhap -a \\\n";
+            print F "       -e ./results/\$qry.mhap.ovb ] ; then\n";
+            print F "  rm -f \$outPath/\$qry.mhap\n";
+            print F "fi\n";
+            print F "\n";
+        }
+
         print F "if [ -e ./results/\$qry.mhap.ovb ] ; then\n";
         print F "  \$bin/overlapPair \\\n";
         print F "    -S ../../$asm.seqStore \\\n";
@@ -530,16 +546,11 @@ sub mhapConfigure ($$$) {
         print F "  && \\\n";
         print F "  mv -f ./results/\$qry.WORKING.ovb ./results/\$qry.ovb\n";
         print F "fi\n";
-    } else {
-        print F "if [ -e ./results/\$qry.mhap.ovb ] ; then\n";
-        print F "  mv -f ./results/\$qry.mhap.ovb ./results/\$qry.ovb\n";
-        print F "fi\n";
+        print F "\n";
+        print F stashFileShellCode($path, "results/\$qry.ovb", "");
+        print F stashFileShellCode($path, "results/\$qry.oc",  "");
+        print F "\n";
     }
-
-    print F "\n";
-    print F stashFileShellCode($path, "results/\$qry.ovb", "");
-    print F stashFileShellCode($path, "results/\$qry.oc",  "");
-    print F "\n";
     print F "exit 0\n";
 
     close(F);
@@ -738,6 +749,10 @@ sub mhapCheck ($$$) {
                 push @miscJobs,    "1-overlapper/results/$1.stats\n";
                 push @miscJobs,    "1-overlapper/results/$1.oc\n";
 
+            } elsif ((getGlobal("${tag}ReAlign") ne "1") &&          #  Not converted to ovb; the
+                     (fileExists("$path/results/$1.mhap"))) {        #  store loads it directly.
+                push @successJobs, "1-overlapper/results/$1.mhap\n";
+
             } else {
                 $failureMessage .= "--   job $path/results/$1.ovb FAILED.\n";
                 push @failedJobs, $currentJobID;
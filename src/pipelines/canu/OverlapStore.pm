@@ -60,11 +60,16 @@ use canu::Grid_Cloud;
 
 
 #  Parallel documentation: Each overlap job is converted into a single bucket of overlaps.  Within
-#  each bucket, the overlaps are distributed into many slices, one per sort job.  The sort jobs then
-#  load the same slice from each bucket.
+#  each bucket, the overlaps are distributed into many bins.  Bins are grouped into slices, one per
+#  sort job.  The sort jobs then load the bins in the same slice from each bucket.
+#
+#  For ovb inputs, the counts are known up front, and each bin is one slice.  For minimap and mhap
+#  text outputs, there are no counts; the text is bucketized directly, and the slices are decided
+#  from the bin sizes once bucketizing is finished.
 
 
-#  NOT FILTERING overlaps by error rate when building the parallel store.
+#  NOT FILTERING ovb overlaps by error rate when building the parallel store.  Text outputs are
+#  filtered as they would have been when converting them to ovb.
 
 
 #
@@ -81,17 +86,19 @@ sub fetchOverlapData ($$@) {
     while (<F>) {
         my $dir;
         my $num;
+        my $ext;
 
-        if (m/^(.*)\/([0-9]*).ovb$/) {
+        if (m/^(.*)\/([0-9]*)\.(ovb|mmap|mhap)$/) {
             $dir = $1;
             $num = $2;
+            $ext = $3;
         } else {
             caExit("didn't recognize ovljob.files line '$_'", undef);
         }
 
-        make_path("$base/$dir");                                  #  Make the output directory.
-        fetchFile("$base/$dir/$num.oc");                          #  Fetch The Counts.   https://www.youtube.com/watch?v=vC0uvUuXVh8
-        fetchFile("$base/$dir/$num.ovb")   if (defined($getD));   #  Fetch the overlap data if told to.
+        make_path("$base/$dir");                                      #  Make the output directory.
+        fetchFile("$base/$dir/$num.oc")     if ($ext eq "ovb");       #  Fetch The Counts.   https://www.youtube.com/watch?v=vC0uvUuXVh8
+        fetchFile("$base/$dir/$num.$ext")   if (defined($getD));      #  Fetch the overlap data if told to.
     }
     close(F);
 }
@@ -109,16 +116,18 @@ sub fetchOverlapDataShellCode ($$) {
     while (<I>) {
         my $dir;
         my $num;
+        my $ext;
 
-        if (m/^(.*)\/([0-9]*).ovb$/) {
+        if (m/^(.*)\/([0-9]*)\.(ovb|mmap|mhap)$/) {
             $dir = $1;
             $num = $2;
+            $ext = $3;
         } else {
             caExit("didn't recognize ovljob.files line '$_'", undef);
         }
 
-        $string .= fetchFileShellCode("$base", "$dir/$num.oc",  "");
-        $string .= fetchFileShellCode("$base", "$dir/$num.ovb", "");
+        $string .= fetchFileShellCode("$base", "$dir/$num.oc",   "")   if ($ext eq "ovb");
+        $string .= fetchFileShellCode("$base", "$dir/$num.$ext", "");
     }
     close(I);
 
@@ -237,7 +246,7 @@ sub createOverlapStoreParallel ($$$$$$) {
     my $path       = "$base/$asm.ovlStore.BUILDING";
 
     goto allDone   if ((fileExists("$path/scripts/1-bucketize.sh")) &&
-                       (fileExists("$path/scripts/2-sort.sh")));
+                       ((fileExists("$path/scripts/2-sort.sh")) || ($numSlices == 0)));
     goto allDone   if ((-d "$base/$asm.ovlStore") || (fileExists("$base/$asm.ovlStore.tar.gz")));
 
     make_path("$path/scripts");
@@ -251,6 +260,9 @@ sub createOverlapStoreParallel ($$$$$$) {
     #  The -f option to bucketizer forces it to overwrite a partial result found
     #  in any 'create####' directory.
     #
+    #  Text inputs are converted while bucketizing, using the same filtering
+    #  the overlapper would have used when converting to ovb.
+    #
     #  Both the binary and the script will stop if the output directory exists.
 
     if (! fileExists("$path/scripts/1-bucketize.sh")) {
@@ -304,6 +316,12 @@ sub createOverlapStoreParallel ($$$$$$) {
         print F "  -O  ./$asm.ovlStore.BUILDING \\\n";
         print F "  -S ../$asm.seqStore \\\n";
         print F "  -C  ./$asm.ovlStore.config \\\n";
+        if ($numSlices == 0) {
+            print F "  -e " . getGlobal("${tag}OvlErrorRate") . " \\\n"   if (getGlobal("${tag}overlapper") eq "minimap");
+            print F "  -partial \\\n"                                     if ((getGlobal("${tag}overlapper") eq "minimap") && ($tag ne "utg"));
+            print F "  -len " . getGlobal("minOverlapLength") . " \\\n"   if (getGlobal("${tag}overlapper") eq "minimap");
+            print F "  -t " . getGlobal("ovbThreads") . " \\\n";
+        }
         print F "  -f \\\n";
         print F "  -b \$jobid \n";
         print F "\n";
@@ -315,9 +333,9 @@ sub createOverlapStoreParallel ($$$$$$) {
             print F "\n";
             print F "cd ./$asm.ovlStore.BUILDING/bucket\$jobname\n";
             print F "\n";
-            print F stashFilesShellCode("$base/$asm.ovlStore.BUILDING/bucket\$jobname", "slice????", "", "purge");
+            print F stashFilesShellCode("$base/$asm.ovlStore.BUILDING/bucket\$jobname", "bin????", "", "purge");
             print F "\n";
-            print F stashFileShellCode("$base/$asm.ovlStore.BUILDING/bucket\$jobname", "sliceSizes", "");
+            print F stashFileShellCode("$base/$asm.ovlStore.BUILDING/bucket\$jobname", "binSizes", "");
             print F "\n";
             print F "cd -\n";
             print F "\n";
@@ -331,8 +349,11 @@ sub createOverlapStoreParallel ($$$$$$) {
     #  Just after starting, ####.started is created.  This is removed on success.
     #  When writing, ####<001> exists.
     #  When finished, ####.started doesn't exist, and ####.info does.
+    #
+    #  If the slices aren't known yet, the sort script is written once they are,
+    #  in configureOverlapStoreSlices().
 
-    if (! fileExists("$path/scripts/2-sort.sh")) {
+    if ((! fileExists("$path/scripts/2-sort.sh")) && ($numSlices > 0)) {
         open(F, "> $path/scripts/2-sort.sh") or caExit("can't open '$path/scripts/2-sort.sh' for writing: $!\n", undef);
         print F "#!" . getGlobal("shell") . "\n";
         print F "\n";
@@ -358,7 +379,7 @@ sub createOverlapStoreParallel ($$$$$$) {
 
         if (defined(getGlobal("objectStore"))) {
             print F "#\n";
-            print F "#  Fetch all the input slices, and each sliceSizes file.\n";
+            print F "#  Fetch all the input bins, and each binSizes file.\n";
             print F "#\n";
             print F "\n";
             print F fetchSeqStoreShellCode($asm, $base, "");
@@ -418,10 +439,10 @@ sub createOverlapStoreParallel ($$$$$$) {
     #  The final job to merge all the indices is done in createOverlapStore() below.
 
     makeExecutable("$path/scripts/1-bucketize.sh");
-    makeExecutable("$path/scripts/2-sort.sh");
+    makeExecutable("$path/scripts/2-sort.sh")   if ($numSlices > 0);
 
     stashFile("$path/scripts/1-bucketize.sh");
-    stashFile("$path/scripts/2-sort.sh");
+    stashFile("$path/scripts/2-sort.sh")        if ($numSlices > 0);
 
   finishStage:
     generateReport($asm);
@@ -459,12 +480,12 @@ sub overlapStoreBucketizerCheck ($$$$$) {
     my @failedJobs;
     my $failureMessage = "";
 
-    #  Two ways to check for completeness, either 'sliceSizes' exists, or the 'bucket' directory
+    #  Two ways to check for completeness, either 'binSizes' exists, or the 'bucket' directory
     #  exists.  The compute is done in a 'create' directory, which is renamed to 'bucket' just
     #  before the job completes.
 
     for (my $bb=1; $bb<=$numBuckets; $bb++) {
-        if (! fileExists("$path/bucket$bucketID/sliceSizes")) {
+        if (! fileExists("$path/bucket$bucketID/binSizes")) {
             $failureMessage .= "--   job $path/bucket$bucketID FAILED.\n";
             push @failedJobs, $currentJobID;
         } else {
@@ -744,6 +765,88 @@ sub deleteOverlapIntermediateFiles ($$@) {
 
 
 
+#  Return the number of buckets, the number of slices and the sort memory
+#  from the description of the store config.  The number of slices is zero
+#  until the slices are configured.
+#
+sub readOverlapStoreConfig ($$) {
+    my $base       = shift @_;
+    my $asm        = shift @_;
+
+    my $numBuckets = 0;
+    my $numSlices  = 0;
+    my $sortMemory = 0;
+
+    open(F, "< $base/$asm.ovlStore.config.txt") or caExit("can't open '$base/$asm.ovlStore.config.txt' for reading: $!\n", undef);
+    while (<F>) {
+        $numBuckets = $1  if (m/numBuckets\s+(\d+)/);
+        $numSlices  = $1  if (m/numSlices\s+(\d+)/);
+        $sortMemory = $1  if (m/sortMemory\s+(\d+)\s+GB/);
+    }
+    close(F);
+
+    return($numBuckets, $numSlices, $sortMemory);
+}
+
+
+
+#  For text inputs, assign the bins to slices now that the bucketizer has
+#  counted the overlaps in each bin, then write the sort script.  Returns
+#  the (possibly new) number of slices and sort memory.
+#
+sub configureOverlapStoreSlices ($$$$$$) {
+    my $base       = shift @_;
+    my $asm        = shift @_;
+    my $tag        = shift @_;
+    my $numBuckets = shift @_;
+    my $numSlices  = shift @_;
+    my $sortMemory = shift @_;
+    my $bin        = getBinDirectory();
+    my $cmd;
+    my $path       = "$base/$asm.ovlStore.BUILDING";
+
+    goto allDone   if ($numSlices > 0);
+    goto allDone   if ((-d "$base/$asm.ovlStore") || (fileExists("$base/$asm.ovlStore.tar.gz")));
+
+    for (my $bb=1; $bb<=$numBuckets; $bb++) {
+        my $bucketID = substr("0000" . $bb, -4);
+
+        fetchFile("$path/bucket$bucketID/binSizes");
+    }
+
+    $cmd  = "$bin/ovStoreConfig \\\n";
+    $cmd .= " -O ./$asm.ovlStore.BUILDING \\\n";
+    $cmd .= " -M " . getGlobal("ovsMemory") . " \\\n";    #  User supplied memory limit, reset below
+    $cmd .= " -slice ./$asm.ovlStore.config \\\n";
+    $cmd .= " > ./$asm.ovlStore.config.txt \\\n";
+    $cmd .= "2> ./$asm.ovlStore.config.err";
+
+    if (runCommand($base, $cmd)) {
+        caExit("failed to configure slices for the overlap store", "$base/$asm.ovlStore.config.err");
+    }
+
+    unlink "$base/$asm.ovlStore.config.err";
+
+    stashFile("$base/$asm.ovlStore.config");
+    stashFile("$base/$asm.ovlStore.config.txt");
+
+    ($numBuckets, $numSlices, $sortMemory) = readOverlapStoreConfig($base, $asm);
+
+    printf STDERR "--\n";
+    printf STDERR "-- Sorting overlap store $base/$asm.ovlStore using:\n";
+    printf STDERR "--   %4d slice%s\n",  $numSlices,  ($numSlices  == 1) ? "" : "s";
+    printf STDERR "--        using at most %d GB memory each\n", $sortMemory;
+
+    setGlobal("ovsMemory", $sortMemory + 2);  #  Actual memory usage of sort jobs (rounded up).
+
+    createOverlapStoreParallel($base, $asm, $tag, $numBuckets, $numSlices, $sortMemory);
+
+  allDone:
+    return($numSlices, $sortMemory);
+}
+
+
+
 sub createOverlapStore ($$) {
     my $asm     = shift @_;
     my $tag     = shift @_;
@@ -813,29 +916,27 @@ sub createOverlapStore ($$) {
         stashFile("$base/$asm.ovlStore.config.txt");
     }
 
-    my $numBuckets = 0;
-    my $numSlices  = 0;
-    my $sortMemory = 0;
-
-    open(F, "< $base/$asm.ovlStore.config.txt") or caExit("can't open '$base/$asm.ovlStore.config.txt' for reading: $!\n", undef);
-    while (<F>) {
-        $numBuckets = $1  if (m/numBuckets\s+(\d+)/);
-        $numSlices  = $1  if (m/numSlices\s+(\d+)/);
-        $sortMemory = $1  if (m/sortMemory\s+(\d+)\s+GB/);
-    }
-    close(F);
+    my ($numBuckets, $numSlices, $sortMemory) = readOverlapStoreConfig($base, $asm);
 
     printf STDERR "--\n";
     printf STDERR "-- Creating overlap store $base/$asm.ovlStore using:\n";
     printf STDERR "--   %4d bucket%s\n", $numBuckets, ($numBuckets == 1) ? "" : "s";
-    printf STDERR "--   %4d slice%s\n",  $numSlices,  ($numSlices  == 1) ? "" : "s";
-    printf STDERR "--        using at most %d GB memory each\n", $sortMemory;
 
-    setGlobal("ovsMemory", $sortMemory + 2);  #  Actual memory usage of sort jobs (rounded up).
+    if ($numSlices > 0) {
+        printf STDERR "--   %4d slice%s\n",  $numSlices,  ($numSlices  == 1) ? "" : "s";
+        printf STDERR "--        using at most %d GB memory each\n", $sortMemory;
+
+        setGlobal("ovsMemory", $sortMemory + 2);  #  Actual memory usage of sort jobs (rounded up).
+    } else {
+        printf STDERR "--   slices configured after bucketizing\n";
+    }
 
     #  If only one slice, do it all in core, otherwise, use the big gun and run it in parallel.
+    #  Text inputs are always done in parallel; the slices are configured once the
+    #  overlaps are bucketized, so there could be only one slice when we're restarted.
 
-    if ($numSlices == 1) {
+    if (($numSlices == 1) &&
+        (! fileExists("$base/$asm.ovlStore.BUILDING/scripts/1-bucketize.sh"))) {
         createOverlapStoreSequential($base, $asm, $tag);
         overlapStoreCheck           ($base, $asm, $tag)   foreach (1..getGlobal("canuIterationMax") + 1);
     }
@@ -843,6 +944,9 @@ sub createOverlapStore ($$) {
     else {
         createOverlapStoreParallel ($base, $asm, $tag, $numBuckets, $numSlices, $sortMemory);
         overlapStoreBucketizerCheck($base, $asm, $tag, $numBuckets, $numSlices)   foreach (1..getGlobal("canuIterationMax") + 1);
+
+        ($numSlices, $sortMemory) = configureOverlapStoreSlices($base, $asm, $tag, $numBuckets, $numSlices, $sortMemory);
+
         overlapStoreSorterCheck    ($base, $asm, $tag, $numBuckets, $numSlices)   foreach (1..getGlobal("canuIterationMax") + 1);
 
         #  Fetch the stats and index data.  If not using an object store, the fetch does nothing,
@@ -29,7 +29,12 @@ use File::Basename;
 
 my $STASH;
 
+#  The stash can be set with CANU_OBJECT_STORE_SIMULATOR_STASH, and
+#  downloads can be made to take CANU_OBJECT_STORE_SIMULATOR_DELAY seconds,
+#  to pretend there is a network in between.
+
 $STASH = "/assembly/objectstore"    if (-d "/assembly/objectstore");
+$STASH = $ENV{"CANU_OBJECT_STORE_SIMULATOR_STASH"}   if (defined($ENV{"CANU_OBJECT_STORE_SIMULATOR_STASH"}));
 
 die "No STASH found\n"  if (!defined($STASH));
 
@@ -300,6 +305,8 @@ sub download (@) {
 
     checkPath($path);
 
+    select(undef, undef, undef, $ENV{"CANU_OBJECT_STORE_SIMULATOR_DELAY"})   if (defined($ENV{"CANU_OBJECT_STORE_SIMULATOR_DELAY"}));
+
     system("cp -fp \"$STASH/$path\" \"$file\" 2> /dev/null");
 }
 
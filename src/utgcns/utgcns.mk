@@ -8,7 +8,7 @@ ifeq "$(strip ${TARGET_DIR})" ""
 endif
 
 TARGET   := utgcns
-SOURCES  := utgcns.C stashContains.C unitigConsensus.C
+SOURCES  := utgcns.C stashContains.C unitigConsensus.C consensusCost.C
 
 SRC_INCDIRS  := .. ../utility ../stores ../overlapInCore/libedlib libpbutgcns libboost
 